@@ -10,6 +10,10 @@
 #include <unordered_map>
 #include <chrono>
 #include <limits>
+#include <numeric>
+#include <vector>
+#include <cstdint>
+#include <cstdlib>
 
 // Remove extern declaration
 // extern std::atomic<int> totalTradesExecuted;
@@ -18,7 +22,8 @@
 // std::unique_ptr<Engine> Engine::instance = nullptr;
 // std::mutex Engine::instanceMutex;
 
-Engine::Engine() : nextOrderId(OrderId(0)), totalTradesExecuted(0) {
+Engine::Engine() : nextOrderId(OrderId(0)), totalTradesExecuted(0), auctionMode(false),
+                   lastAuctionPrice(0), lastAuctionVolume(0) {
     std::cout << "Trading Engine started" << std::endl;
 }
 
@@ -43,20 +48,48 @@ OrderId Engine::generateNextOrderId() {
 void Engine::addOrderToBook(std::shared_ptr<Order> order) {
     if (order->type == OrderType::BUY) {
         std::lock_guard<std::mutex> lock(buyOrdersMutex);
-        buyOrders[order->price].push(order);
+        auto& level = buyOrders[order->price];
+        level.orders.push(order);
+        level.volume += order->remainingAmount.value;
     } else {
         std::lock_guard<std::mutex> lock(sellOrdersMutex);
-        sellOrders[order->price].push(order);
+        auto& level = sellOrders[order->price];
+        level.orders.push(order);
+        level.volume += order->remainingAmount.value;
     }
 }
 
+// Helper method to rest an order in the book while an auction is running.
+// Returns false if the auction was uncrossed before the book lock was taken.
+bool Engine::addOrderToAuction(std::shared_ptr<Order> order) {
+    if (order->type == OrderType::BUY) {
+        std::lock_guard<std::mutex> lock(buyOrdersMutex);
+        if (!auctionMode.load()) {
+            return false;
+        }
+        auto& level = buyOrders[order->price];
+        level.orders.push(order);
+        level.volume += order->remainingAmount.value;
+    } else {
+        std::lock_guard<std::mutex> lock(sellOrdersMutex);
+        if (!auctionMode.load()) {
+            return false;
+        }
+        auto& level = sellOrders[order->price];
+        level.orders.push(order);
+        level.volume += order->remainingAmount.value;
+    }
+    return true;
+}
+
 // Helper method to remove order from the appropriate order book
 bool Engine::removeOrderFromBook(std::shared_ptr<Order> order) {
     bool found = false;
     
     if (order->type == OrderType::BUY) {
         std::lock_guard<std::mutex> lock(buyOrdersMutex);
-        auto& queue = buyOrders[order->price];
+        auto& level = buyOrders[order->price];
+        auto& queue = level.orders;
         size_t size = queue.size();
         
         for (size_t i = 0; i < size; ++i) {
@@ -65,6 +98,7 @@ bool Engine::removeOrderFromBook(std::shared_ptr<Order> order) {
             if (front->orderId != order->orderId) {
                 queue.push(front);
             } else {
+                level.volume -= front->remainingAmount.value;
                 found = true;
             }
         }
@@ -74,7 +108,8 @@ bool Engine::removeOrderFromBook(std::shared_ptr<Order> order) {
         }
     } else {
         std::lock_guard<std::mutex> lock(sellOrdersMutex);
-        auto& queue = sellOrders[order->price];
+        auto& level = sellOrders[order->price];
+        auto& queue = level.orders;
         size_t size = queue.size();
         
         for (size_t i = 0; i < size; ++i) {
@@ -83,6 +118,7 @@ bool Engine::removeOrderFromBook(std::shared_ptr<Order> order) {
             if (front->orderId != order->orderId) {
                 queue.push(front);
             } else {
+                level.volume -= front->remainingAmount.value;
                 found = true;
             }
         }
@@ -124,8 +160,10 @@ Response Engine::placeOrder(OrderType type, Price price, Amount amount, std::sha
         orders[orderId] = order;
     }
 
-    // Try to match orders first
-    matchOrders(order);
+    // During an auction orders rest in the book until the uncross
+    if (!auctionMode.load() || !addOrderToAuction(order)) {
+        matchOrders(order);
+    }
 
     return Response(ResponseStatus::SUCCESS, "Order placed successfully", orderId);
 }
@@ -187,7 +225,8 @@ void Engine::matchOrders(std::shared_ptr<Order> newOrder) {
             // For buy orders, look at sell orders
             std::lock_guard<std::mutex> sellLock(sellOrdersMutex);
             for (auto it = sellOrders.begin(); it != sellOrders.end() && newOrder->remainingAmount.value > 0;) {
-                auto& [price, queue] = *it;
+                auto& [price, level] = *it;
+                auto& queue = level.orders;
                 
                 if (price.value > newOrder->price.value) {
                     break; // No more matching prices
@@ -201,6 +240,7 @@ void Engine::matchOrders(std::shared_ptr<Order> newOrder) {
                     
                     // Execute trade
                     executeTrade(newOrder, sellOrder, tradeAmount);
+                    level.volume -= tradeAmount.value;
                     
                     if (sellOrder->remainingAmount.value > 0) {
                         queue.push(sellOrder);
@@ -218,7 +258,8 @@ void Engine::matchOrders(std::shared_ptr<Order> newOrder) {
             // For sell orders, look at buy orders
             std::lock_guard<std::mutex> buyLock(buyOrdersMutex);
             for (auto it = buyOrders.begin(); it != buyOrders.end() && newOrder->remainingAmount.value > 0;) {
-                auto& [price, queue] = *it;
+                auto& [price, level] = *it;
+                auto& queue = level.orders;
                 
                 if (price.value < newOrder->price.value) {
                     break; // No more matching prices
@@ -232,6 +273,7 @@ void Engine::matchOrders(std::shared_ptr<Order> newOrder) {
                     
                     // Execute trade
                     executeTrade(buyOrder, newOrder, tradeAmount);
+                    level.volume -= tradeAmount.value;
                     
                     if (buyOrder->remainingAmount.value > 0) {
                         queue.push(buyOrder);
@@ -260,10 +302,164 @@ void Engine::matchOrders(std::shared_ptr<Order> newOrder) {
     }
 }
 
+void Engine::startAuction() {
+    auctionMode.store(true);
+    std::cout << "\nAuction started, orders will rest until uncross" << std::endl;
+}
+
+Response Engine::uncrossAuction() {
+    auto start = std::chrono::high_resolution_clock::now();
+    
+    if (!auctionMode.load()) {
+        return Response(ResponseStatus::SYSTEM_ERROR, "Engine is not in auction mode");
+    }
+    
+    Price equilibriumPrice(0);
+    int64_t matchedVolume = 0;
+    
+    {
+        std::lock_guard<std::mutex> buyLock(buyOrdersMutex);
+        std::lock_guard<std::mutex> sellLock(sellOrdersMutex);
+        
+        if (!buyOrders.empty() && !sellOrders.empty() &&
+            buyOrders.begin()->first.value >= sellOrders.begin()->first.value) {
+            Price bestBid = buyOrders.begin()->first;
+            Price bestAsk = sellOrders.begin()->first;
+            
+            // Merge the price levels inside the crossed range [bestAsk, bestBid] in ascending order
+            std::vector<int32_t> levels;
+            std::vector<int64_t> buyVolume;
+            std::vector<int64_t> sellVolume;
+            
+            auto buyLevel = std::make_reverse_iterator(buyOrders.upper_bound(bestAsk));
+            auto sellLevel = sellOrders.begin();
+            auto sellEnd = sellOrders.upper_bound(bestBid);
+            
+            while (buyLevel != buyOrders.rend() || sellLevel != sellEnd) {
+                int32_t price = std::numeric_limits<int32_t>::max();
+                if (buyLevel != buyOrders.rend()) {
+                    price = std::min(price, buyLevel->first.value);
+                }
+                if (sellLevel != sellEnd) {
+                    price = std::min(price, sellLevel->first.value);
+                }
+                
+                int64_t buyQty = 0;
+                int64_t sellQty = 0;
+                if (buyLevel != buyOrders.rend() && buyLevel->first.value == price) {
+                    buyQty = buyLevel->second.volume;
+                    ++buyLevel;
+                }
+                if (sellLevel != sellEnd && sellLevel->first.value == price) {
+                    sellQty = sellLevel->second.volume;
+                    ++sellLevel;
+                }
+                
+                levels.push_back(price);
+                buyVolume.push_back(buyQty);
+                sellVolume.push_back(sellQty);
+            }
+            
+            // Cumulative curves: demand at or above each price, supply at or below it
+            size_t numLevels = levels.size();
+            std::vector<int64_t> demand(numLevels);
+            std::vector<int64_t> supply(numLevels);
+            std::inclusive_scan(buyVolume.rbegin(), buyVolume.rend(), demand.rbegin());
+            std::inclusive_scan(sellVolume.begin(), sellVolume.end(), supply.begin());
+            
+            std::vector<int64_t> executable(numLevels);
+            std::vector<int64_t> imbalance(numLevels);
+            for (size_t i = 0; i < numLevels; ++i) {
+                executable[i] = std::min(demand[i], supply[i]);
+                imbalance[i] = std::abs(demand[i] - supply[i]);
+            }
+            
+            // Equilibrium: maximum executable volume, then minimum imbalance, then lowest price
+            size_t best = 0;
+            for (size_t i = 1; i < numLevels; ++i) {
+                if (executable[i] > executable[best] ||
+                    (executable[i] == executable[best] && imbalance[i] < imbalance[best])) {
+                    best = i;
+                }
+            }
+            
+            equilibriumPrice = Price(levels[best]);
+            matchedVolume = executable[best];
+            
+            // Allocate fills in one sweep, price-time priority on both sides
+            int64_t remaining = matchedVolume;
+            auto buyIt = buyOrders.begin();
+            auto sellIt = sellOrders.begin();
+            
+            while (remaining > 0) {
+                auto& buyQueue = buyIt->second.orders;
+                auto& sellQueue = sellIt->second.orders;
+                auto buyOrder = buyQueue.front();
+                auto sellOrder = sellQueue.front();
+                
+                Amount tradeAmount(static_cast<int32_t>(std::min<int64_t>(
+                    {remaining, buyOrder->remainingAmount.value, sellOrder->remainingAmount.value})));
+                
+                executeTrade(buyOrder, sellOrder, tradeAmount, equilibriumPrice);
+                remaining -= tradeAmount.value;
+                buyIt->second.volume -= tradeAmount.value;
+                sellIt->second.volume -= tradeAmount.value;
+                
+                if (buyOrder->remainingAmount.value == 0) {
+                    buyQueue.pop();
+                    if (buyQueue.empty()) {
+                        buyIt = buyOrders.erase(buyIt);
+                    }
+                }
+                
+                if (sellOrder->remainingAmount.value == 0) {
+                    sellQueue.pop();
+                    if (sellQueue.empty()) {
+                        sellIt = sellOrders.erase(sellIt);
+                    }
+                }
+            }
+        }
+        
+        lastAuctionPrice.store(equilibriumPrice.value);
+        lastAuctionVolume.store(matchedVolume);
+        
+        // Resume continuous matching while both books are still locked
+        auctionMode.store(false);
+    }
+    
+    auto now = std::chrono::high_resolution_clock::now();
+    auto duration = std::chrono::duration_cast<std::chrono::microseconds>(now - start);
+    
+    std::cout << "\n[Time: " << duration.count() << "μs] Auction uncrossed at Price: "
+              << equilibriumPrice.value << " Volume: " << matchedVolume << std::endl;
+    logOrderBookState();
+    
+    if (matchedVolume == 0) {
+        return Response(ResponseStatus::SUCCESS, "Auction closed without crossing orders");
+    }
+    
+    return Response(ResponseStatus::SUCCESS, "Auction uncrossed at price " + std::to_string(equilibriumPrice.value));
+}
+
+Price Engine::getBestBid() {
+    std::lock_guard<std::mutex> lock(buyOrdersMutex);
+    return buyOrders.empty() ? Price(0) : buyOrders.begin()->first;
+}
+
+Price Engine::getBestAsk() {
+    std::lock_guard<std::mutex> lock(sellOrdersMutex);
+    return sellOrders.empty() ? Price(0) : sellOrders.begin()->first;
+}
+
 void Engine::executeTrade(std::shared_ptr<Order> buyOrder, std::shared_ptr<Order> sellOrder, Amount tradeAmount) {
     // Calculate trade price (use the price from the order that was in the book)
     Price tradePrice = (buyOrder->type == OrderType::BUY) ? sellOrder->price : buyOrder->price;
     
+    executeTrade(buyOrder, sellOrder, tradeAmount, tradePrice);
+}
+
+void Engine::executeTrade(std::shared_ptr<Order> buyOrder, std::shared_ptr<Order> sellOrder, Amount tradeAmount, Price tradePrice) {
     // Update remaining amounts
     buyOrder->remainingAmount.value -= tradeAmount.value;
     sellOrder->remainingAmount.value -= tradeAmount.value;
@@ -289,16 +485,16 @@ void Engine::logOrderBookState() {
     {
         std::lock_guard<std::mutex> buyLock(buyOrdersMutex);
         std::cout << "Buy Orders:" << std::endl;
-        for (const auto& [price, queue] : buyOrders) {
-            std::cout << "Price: " << price.value << " - Orders: " << queue.size() << std::endl;
+        for (const auto& [price, level] : buyOrders) {
+            std::cout << "Price: " << price.value << " - Orders: " << level.orders.size() << std::endl;
         }
     }
     
     {
         std::lock_guard<std::mutex> sellLock(sellOrdersMutex);
         std::cout << "Sell Orders:" << std::endl;
-        for (const auto& [price, queue] : sellOrders) {
-            std::cout << "Price: " << price.value << " - Orders: " << queue.size() << std::endl;
+        for (const auto& [price, level] : sellOrders) {
+            std::cout << "Price: " << price.value << " - Orders: " << level.orders.size() << std::endl;
         }
     }
     
@@ -311,9 +507,9 @@ Engine::~Engine() {
     // Clear all orders from the order books
     {
         std::lock_guard<std::mutex> buyLock(buyOrdersMutex);
-        for (auto& [price, queue] : buyOrders) {
-            while (!queue.empty()) {
-                queue.pop();
+        for (auto& [price, level] : buyOrders) {
+            while (!level.orders.empty()) {
+                level.orders.pop();
             }
         }
         buyOrders.clear();
@@ -321,9 +517,9 @@ Engine::~Engine() {
     
     {
         std::lock_guard<std::mutex> sellLock(sellOrdersMutex);
-        for (auto& [price, queue] : sellOrders) {
-            while (!queue.empty()) {
-                queue.pop();
+        for (auto& [price, level] : sellOrders) {
+            while (!level.orders.empty()) {
+                level.orders.pop();
             }
         }
         sellOrders.clear();
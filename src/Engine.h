@@ -7,6 +7,7 @@
 #include <string>
 #include <memory>
 #include <unordered_map>
+#include <cstdint>
 #include "Order.h"
 #include "Types.h"
 
@@ -29,6 +30,12 @@ struct Response {
         : status(s), reason(r), orderId(id) {}
 };
 
+// Orders resting at one price in FIFO order, with their total remaining amount
+struct PriceLevel {
+    std::queue<std::shared_ptr<Order>> orders;
+    int64_t volume = 0;
+};
+
 class Engine {
 public:
     // Constants for order ID limits
@@ -51,6 +58,23 @@ public:
     // Get total trades executed
     int getTotalTradesExecuted() const { return totalTradesExecuted.load(); }
     
+    // Call auction mode: orders rest in the book without matching until uncrossed
+    void startAuction();
+    
+    // Uncross the auction at the equilibrium price and resume continuous matching
+    Response uncrossAuction();
+    
+    // Check whether the engine is collecting orders for an auction
+    bool isInAuction() const { return auctionMode.load(); }
+    
+    // Get the equilibrium price and matched volume of the last uncross
+    Price getLastAuctionPrice() const { return Price(lastAuctionPrice.load()); }
+    int64_t getLastAuctionVolume() const { return lastAuctionVolume.load(); }
+    
+    // Get best bid / best ask, Price(0) if that side of the book is empty
+    Price getBestBid();
+    Price getBestAsk();
+    
     // Destructor
     ~Engine();
     
@@ -61,9 +85,16 @@ private:
     // Total trades executed counter
     std::atomic<int> totalTradesExecuted;
     
+    // Auction mode flag, only cleared while holding both book mutexes
+    std::atomic<bool> auctionMode;
+    
+    // Result of the last auction uncross
+    std::atomic<int32_t> lastAuctionPrice;
+    std::atomic<int64_t> lastAuctionVolume;
+    
     // Order books with shared pointers
-    std::map<Price, std::queue<std::shared_ptr<Order>>, std::greater<Price>> buyOrders;
-    std::map<Price, std::queue<std::shared_ptr<Order>>> sellOrders;
+    std::map<Price, PriceLevel, std::greater<Price>> buyOrders;
+    std::map<Price, PriceLevel> sellOrders;
     
     // Use shared_ptr for order tracking
     std::unordered_map<OrderId, std::shared_ptr<Order>> orders;
@@ -86,6 +117,10 @@ private:
     bool removeOrderFromBook(std::shared_ptr<Order> order);
     void addOrderToBook(std::shared_ptr<Order> order);
     
+    // Helper method to rest an order in the book during an auction
+    bool addOrderToAuction(std::shared_ptr<Order> order);
+    
     // Helper method to execute a trade between two orders
     void executeTrade(std::shared_ptr<Order> buyOrder, std::shared_ptr<Order> sellOrder, Amount tradeAmount);
+    void executeTrade(std::shared_ptr<Order> buyOrder, std::shared_ptr<Order> sellOrder, Amount tradeAmount, Price tradePrice);
 }; 
\ No newline at end of file
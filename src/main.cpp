@@ -8,6 +8,7 @@
 #include <atomic>
 #include <iostream>
 #include <iomanip>
+#include <vector>
 
 std::atomic<int> totalOrdersProcessed(0);
 std::atomic<int> totalOrdersCanceled(0);
@@ -99,7 +100,98 @@ void clientThread(std::shared_ptr<Client> client, Engine& engine, int numOrders)
     }
 }
 
+// Fixed opening auction book with a known uncross: 100 for 186, leaving bid 99 / ask 100
+bool runOpeningAuctionScenario() {
+    struct ScenarioOrder {
+        OrderType type;
+        int32_t price;
+        int32_t amount;
+    };
+    const ScenarioOrder book[] = {
+        {OrderType::BUY, 109, 8},   {OrderType::BUY, 109, 15}, {OrderType::BUY, 102, 97},
+        {OrderType::BUY, 100, 66},  {OrderType::BUY, 99, 30},
+        {OrderType::SELL, 90, 76},  {OrderType::SELL, 95, 80}, {OrderType::SELL, 100, 47},
+        {OrderType::SELL, 105, 20},
+    };
+
+    Engine engine;
+    auto buyer = std::make_shared<Client>("AuctionBuyer");
+    auto seller = std::make_shared<Client>("AuctionSeller");
+
+    engine.startAuction();
+    for (const auto& order : book) {
+        auto client = order.type == OrderType::BUY ? buyer : seller;
+        engine.placeOrder(order.type, Price(order.price), Amount(order.amount), client);
+    }
+    engine.uncrossAuction();
+
+    Price auctionPrice = engine.getLastAuctionPrice();
+    int64_t auctionVolume = engine.getLastAuctionVolume();
+    Price bestBid = engine.getBestBid();
+    Price bestAsk = engine.getBestAsk();
+
+    bool passed = auctionPrice.value == 100 && auctionVolume == 186 &&
+                  bestBid.value == 99 && bestAsk.value == 100 && !engine.isInAuction();
+
+    std::cout << "\n=== Opening Auction Scenario ===" << std::endl;
+    std::cout << "Uncross price: " << auctionPrice.value << " (expected 100)" << std::endl;
+    std::cout << "Uncross volume: " << auctionVolume << " (expected 186)" << std::endl;
+    std::cout << "Best bid/ask after uncross: " << bestBid.value << "/" << bestAsk.value
+              << " (expected 99/100)" << std::endl;
+    std::cout << "Opening auction scenario " << (passed ? "PASSED" : "FAILED") << std::endl;
+    return passed;
+}
+
+// Time the same seeded burst matched continuously and uncrossed in a single auction
+void compareBurstMatching(int burstSize) {
+    struct BurstOrder {
+        OrderType type;
+        int32_t price;
+        int32_t amount;
+    };
+    std::mt19937 gen(42);
+    std::uniform_int_distribution<> priceDist(90, 110);
+    std::uniform_int_distribution<> amountDist(1, 100);
+    std::uniform_int_distribution<> orderTypeDist(0, 1);
+
+    std::vector<BurstOrder> burst;
+    burst.reserve(burstSize);
+    for (int i = 0; i < burstSize; ++i) {
+        OrderType type = orderTypeDist(gen) == 0 ? OrderType::BUY : OrderType::SELL;
+        burst.push_back({type, priceDist(gen), amountDist(gen)});
+    }
+
+    auto client = std::make_shared<Client>("BurstClient");
+
+    Engine continuousEngine;
+    auto continuousStart = std::chrono::high_resolution_clock::now();
+    for (const auto& order : burst) {
+        continuousEngine.placeOrder(order.type, Price(order.price), Amount(order.amount), client);
+    }
+    auto continuousDuration = std::chrono::duration_cast<std::chrono::microseconds>(
+        std::chrono::high_resolution_clock::now() - continuousStart);
+
+    Engine auctionEngine;
+    auto auctionStart = std::chrono::high_resolution_clock::now();
+    auctionEngine.startAuction();
+    for (const auto& order : burst) {
+        auctionEngine.placeOrder(order.type, Price(order.price), Amount(order.amount), client);
+    }
+    auctionEngine.uncrossAuction();
+    auto auctionDuration = std::chrono::duration_cast<std::chrono::microseconds>(
+        std::chrono::high_resolution_clock::now() - auctionStart);
+
+    std::cout << "\n=== Burst Matching Comparison (" << burstSize << " orders) ===" << std::endl;
+    std::cout << "Continuous: " << continuousDuration.count() << "μs, "
+              << continuousEngine.getTotalTradesExecuted() << " trades" << std::endl;
+    std::cout << "Auction uncross: " << auctionDuration.count() << "μs, "
+              << auctionEngine.getTotalTradesExecuted() << " trades" << std::endl;
+}
+
 int main() {
+    bool auctionPassed = runOpeningAuctionScenario();
+    compareBurstMatching(2000);
+
     const int ordersPerClient = 10;
     std::cout << "Starting trading engine test with " << ordersPerClient << " orders per client..." << std::endl;
     Engine engine;
@@ -131,5 +223,5 @@ int main() {
     std::cout << "Total trades executed: " << engine.getTotalTradesExecuted() << std::endl;
     std::cout << "Total orders canceled: " << totalOrdersCanceled << std::endl;
 
-    return 0;
+    return auctionPassed ? 0 : 1;
 } 
\ No newline at end of file